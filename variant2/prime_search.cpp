@@ -7,7 +7,10 @@
 #include <cmath>
 #include <sstream>
 #include <iomanip>
+#include <algorithm>
 #include <atomic>
+#include <functional>
+#include <numeric>
 
 std::string strip_whitespace(const std::string& str) {
     auto start = str.find_first_not_of(" \t\n\r");
@@ -19,12 +22,25 @@ std::string strip_whitespace(const std::string& str) {
 struct Settings {
     int thread_count;
     uint64_t upper_limit;
+    bool auto_threads;
+    bool factor_mode;
+    uint64_t lower_limit;
 };
 
 std::mutex output_lock;
 
+uint64_t parse_limit(const std::string& val) {
+    if (val.find("2^") == 0) {
+        int exp = std::stoi(val.substr(2));
+        return (exp == 64) ? UINT64_MAX : (1ULL << exp);
+    }
+    return std::stoull(val);
+}
+
 Settings load_configuration(const std::string& filepath) {
-    Settings settings;
+    Settings settings{};
+    settings.lower_limit = 2;
+    bool has_lower_limit = false;
     std::ifstream input(filepath);
     if (!input.is_open()) {
         throw std::runtime_error("Failed to open configuration file: " + filepath);
@@ -42,16 +58,34 @@ Settings load_configuration(const std::string& filepath) {
         std::string val = strip_whitespace(line.substr(delimiter + 1));
 
         if (key == "Threads") {
-            settings.thread_count = std::stoi(val);
-        } else if (key == "Max Value") {
-            if (val.find("2^") == 0) {
-                int exp = std::stoi(val.substr(2));
-                settings.upper_limit = (exp == 64) ? UINT64_MAX : (1ULL << exp);
+            if (val == "auto") {
+                settings.auto_threads = true;
             } else {
-                settings.upper_limit = std::stoull(val);
+                settings.thread_count = std::stoi(val);
+            }
+        } else if (key == "Max Value") {
+            settings.upper_limit = parse_limit(val);
+        } else if (key == "Min Value") {
+            settings.lower_limit = parse_limit(val);
+            has_lower_limit = true;
+        } else if (key == "Mode") {
+            if (val == "factor") {
+                settings.factor_mode = true;
+            } else if (val != "prime") {
+                throw std::runtime_error("Unknown Mode: " + val + " (expected prime or factor)");
             }
         }
     }
+
+    if (!settings.auto_threads && settings.thread_count < 1) {
+        throw std::runtime_error("Threads must be at least 1 or auto");
+    }
+    if (has_lower_limit && !settings.factor_mode) {
+        throw std::runtime_error("Min Value is only supported with Mode = factor");
+    }
+    if (settings.factor_mode && settings.lower_limit > settings.upper_limit) {
+        throw std::runtime_error("Min Value must not exceed Max Value");
+    }
     return settings;
 }
 
@@ -62,8 +96,8 @@ std::string get_timestamp(const std::chrono::system_clock::time_point& point) {
     return stream.str();
 }
 
-// Thread-based divisibility testing with logging
-bool check_primality_threaded(uint64_t num, int num_threads) {
+// Thread-based divisibility testing, logging each divisor to log under output_lock
+bool check_primality_threaded(uint64_t num, int num_threads, std::ostream& log) {
     if (num < 2) return false;
     if (num == 2) return true;
     
@@ -71,8 +105,8 @@ bool check_primality_threaded(uint64_t num, int num_threads) {
     if (num % 2 == 0) {
         auto now = std::chrono::system_clock::now();
         std::lock_guard<std::mutex> guard(output_lock);
-        std::cout << "[" << get_timestamp(now) << "] [Thread 0] checked divisor 2 for " << num 
-                  << " - COMPOSITE" << std::endl;
+        log << "[" << get_timestamp(now) << "] [Thread 0] checked divisor 2 for " << num 
+            << " - COMPOSITE" << std::endl;
         return false;
     }
     
@@ -97,17 +131,17 @@ bool check_primality_threaded(uint64_t num, int num_threads) {
                 auto now = std::chrono::system_clock::now();
                 {
                     std::lock_guard<std::mutex> guard(output_lock);
-                    std::cout << "[" << get_timestamp(now) << "] [Thread " << i 
-                              << "] checking divisor " << div << " for " << num << std::endl;
+                    log << "[" << get_timestamp(now) << "] [Thread " << i 
+                        << "] checking divisor " << div << " for " << num << std::endl;
                 }
                 
                 if (num % div == 0) {
                     is_composite.store(true);
                     auto now2 = std::chrono::system_clock::now();
                     std::lock_guard<std::mutex> guard(output_lock);
-                    std::cout << "[" << get_timestamp(now2) << "] [Thread " << i 
-                              << "] divisor " << div << " divides " << num 
-                              << " - COMPOSITE" << std::endl;
+                    log << "[" << get_timestamp(now2) << "] [Thread " << i 
+                        << "] divisor " << div << " divides " << num 
+                        << " - COMPOSITE" << std::endl;
                     return;
                 }
             }
@@ -119,6 +153,418 @@ bool check_primality_threaded(uint64_t num, int num_threads) {
     return !is_composite.load();
 }
 
+// ---------- Factorization engine (Mode = factor) ----------
+
+// Odd primes below this bound are stripped by trial division before Pollard-Brent rho
+const uint32_t SMALL_PRIME_LIMIT = 1024;
+const uint64_t FACTOR_MAX_BATCH_SIZE = 4096;
+const uint64_t FACTOR_BATCHES_PER_THREAD = 4;
+
+// A divides n exactly when n * inverse <= limit (inverse is the prime's inverse mod 2^64),
+// which avoids a hardware division per trial
+struct SmallPrime {
+    uint32_t prime;
+    uint64_t inverse;
+    uint64_t limit;
+};
+
+const std::vector<SmallPrime>& small_prime_table() {
+    static const std::vector<SmallPrime> table = [] {
+        std::vector<SmallPrime> primes;
+        std::vector<bool> composite(SMALL_PRIME_LIMIT, false);
+        for (uint32_t p = 3; p < SMALL_PRIME_LIMIT; p += 2) {
+            if (composite[p]) continue;
+            for (uint32_t m = p * p; m < SMALL_PRIME_LIMIT; m += 2 * p) composite[m] = true;
+
+            uint64_t inverse = p;
+            for (int i = 0; i < 5; ++i) inverse *= 2 - p * inverse;
+            primes.push_back({p, inverse, UINT64_MAX / p});
+        }
+        return primes;
+    }();
+    return table;
+}
+
+// Montgomery arithmetic modulo an odd 64-bit n, with R = 2^64
+struct Montgomery {
+    uint64_t mod;
+    uint64_t inverse;  // mod^-1 mod 2^64
+    uint64_t r2;       // R^2 mod n
+    uint64_t one;      // R mod n
+
+    explicit Montgomery(uint64_t n) : mod(n) {
+        inverse = n;
+        for (int i = 0; i < 5; ++i) inverse *= 2 - n * inverse;
+        one = (0 - n) % n;
+        r2 = static_cast<uint64_t>(static_cast<unsigned __int128>(one) * one % n);
+    }
+
+    uint64_t reduce(unsigned __int128 t) const {
+        uint64_t q = static_cast<uint64_t>(t) * inverse;
+        uint64_t high = static_cast<uint64_t>(t >> 64);
+        uint64_t qn_high = static_cast<uint64_t>((static_cast<unsigned __int128>(q) * mod) >> 64);
+        return (high >= qn_high) ? high - qn_high : high - qn_high + mod;
+    }
+
+    uint64_t multiply(uint64_t a, uint64_t b) const {
+        return reduce(static_cast<unsigned __int128>(a) * b);
+    }
+
+    uint64_t add(uint64_t a, uint64_t b) const {
+        uint64_t sum = a + b;
+        return (sum < a || sum >= mod) ? sum - mod : sum;
+    }
+
+    uint64_t to_montgomery(uint64_t a) const { return multiply(a % mod, r2); }
+
+    uint64_t power(uint64_t base, uint64_t exp) const {
+        uint64_t result = one;
+        while (exp) {
+            if (exp & 1) result = multiply(result, base);
+            base = multiply(base, base);
+            exp >>= 1;
+        }
+        return result;
+    }
+};
+
+// Deterministic Miller-Rabin for odd n > 2; these seven bases cover every 64-bit integer
+bool is_probable_prime(uint64_t n) {
+    static const uint64_t bases[] = {2, 325, 9375, 28178, 450775, 9780504, 1795265022};
+
+    Montgomery mont(n);
+    uint64_t d = n - 1;
+    int shifts = 0;
+    while ((d & 1) == 0) { d >>= 1; ++shifts; }
+    uint64_t minus_one = mont.mod - mont.one;
+
+    for (uint64_t base : bases) {
+        if (base % n == 0) continue;
+        uint64_t x = mont.power(mont.to_montgomery(base), d);
+        if (x == mont.one || x == minus_one) continue;
+
+        bool witness = true;
+        for (int i = 1; i < shifts && witness; ++i) {
+            x = mont.multiply(x, x);
+            if (x == minus_one) witness = false;
+        }
+        if (witness) return false;
+    }
+    return true;
+}
+
+// Pollard-Brent rho on an odd composite n, batching gcds over products of differences
+uint64_t find_factor_pollard_brent(uint64_t n) {
+    const uint64_t batch = 128;
+    Montgomery mont(n);
+
+    for (uint64_t c = 1; ; ++c) {
+        uint64_t step = mont.to_montgomery(c);
+        auto next = [&](uint64_t v) { return mont.add(mont.multiply(v, v), step); };
+        auto distance = [](uint64_t a, uint64_t b) { return a > b ? a - b : b - a; };
+
+        uint64_t x = 0, y = mont.to_montgomery(2), saved_y = y;
+        uint64_t product = mont.one, divisor = 1;
+
+        for (uint64_t r = 1; divisor == 1; r <<= 1) {
+            x = y;
+            for (uint64_t i = 0; i < r; ++i) y = next(y);
+            for (uint64_t k = 0; k < r && divisor == 1; k += batch) {
+                saved_y = y;
+                for (uint64_t i = 0; i < std::min(batch, r - k); ++i) {
+                    y = next(y);
+                    product = mont.multiply(product, distance(x, y));
+                }
+                divisor = std::gcd(product, n);
+            }
+        }
+
+        // The batched product hit zero; replay the last batch one step at a time
+        if (divisor == n) {
+            do {
+                saved_y = next(saved_y);
+                divisor = std::gcd(distance(x, saved_y), n);
+            } while (divisor == 1);
+        }
+        if (divisor != n) return divisor;
+    }
+}
+
+void split_large_factor(uint64_t n, std::vector<uint64_t>& factors) {
+    if (is_probable_prime(n)) {
+        factors.push_back(n);
+        return;
+    }
+    uint64_t divisor = find_factor_pollard_brent(n);
+    split_large_factor(divisor, factors);
+    split_large_factor(n / divisor, factors);
+}
+
+// Appends the prime factors of n (n >= 2) to factors in ascending order
+void factorize(uint64_t n, std::vector<uint64_t>& factors) {
+    size_t first = factors.size();
+
+    while ((n & 1) == 0) {
+        factors.push_back(2);
+        n >>= 1;
+    }
+
+    bool cofactor_is_prime = false;
+    for (const auto& sp : small_prime_table()) {
+        if (static_cast<uint64_t>(sp.prime) * sp.prime > n) {
+            cofactor_is_prime = true;
+            break;
+        }
+        while (n * sp.inverse <= sp.limit) {
+            factors.push_back(sp.prime);
+            n *= sp.inverse;
+        }
+    }
+
+    if (n > 1) {
+        // Trial division reached sqrt(n) only if the cofactor is prime; otherwise use Miller-Rabin and rho
+        if (cofactor_is_prime) {
+            factors.push_back(n);
+        } else {
+            split_large_factor(n, factors);
+            std::sort(factors.begin() + first, factors.end());
+        }
+    }
+}
+
+// Factorizations for one batch, stored flat: the factors of values[i] are
+// factors[offsets[i]] up to factors[offsets[i + 1]]
+struct FactorBatch {
+    int worker_id;
+    std::chrono::system_clock::time_point completed_at;
+    std::vector<uint64_t> values;
+    std::vector<size_t> offsets;
+    std::vector<uint64_t> factors;
+};
+
+// Batches shrink for small ranges so every thread gets several of them
+uint64_t factor_batch_size(uint64_t lower, uint64_t upper, int num_threads) {
+    uint64_t per_batch = (upper - lower) / (FACTOR_BATCHES_PER_THREAD * num_threads) + 1;
+    return std::min(per_batch, FACTOR_MAX_BATCH_SIZE);
+}
+
+// Factors every number in [lower, upper] on a pool of workers that claim
+// factor_batch_size numbers at a time; on_batch runs on the worker thread
+void run_factor_pool(uint64_t lower, uint64_t upper, int num_threads,
+                     const std::function<void(FactorBatch&)>& on_batch) {
+    uint64_t batch_size = factor_batch_size(lower, upper, num_threads);
+    uint64_t batch_count = (upper - lower) / batch_size + 1;
+    std::atomic<uint64_t> next_batch(0);
+    std::vector<std::thread> workers;
+
+    for (int i = 0; i < num_threads; ++i) {
+        workers.emplace_back([&, i]() {
+            for (uint64_t b = next_batch++; b < batch_count; b = next_batch++) {
+                uint64_t first = lower + b * batch_size;
+                uint64_t last = (upper - first < batch_size - 1) ? upper : first + batch_size - 1;
+
+                FactorBatch batch;
+                batch.worker_id = i;
+                batch.values.reserve(last - first + 1);
+                batch.offsets.reserve(last - first + 2);
+                batch.offsets.push_back(0);
+                for (uint64_t num = first; ; ++num) {
+                    if (num >= 2) {
+                        batch.values.push_back(num);
+                        factorize(num, batch.factors);
+                        batch.offsets.push_back(batch.factors.size());
+                    }
+                    if (num == last) break;
+                }
+                batch.completed_at = std::chrono::system_clock::now();
+                on_batch(batch);
+            }
+        });
+    }
+
+    for (auto& w : workers) w.join();
+}
+
+void write_factorization(std::ostream& out, const FactorBatch& batch, size_t k) {
+    out << batch.values[k] << " = ";
+    for (size_t j = batch.offsets[k]; j < batch.offsets[k + 1]; ++j) {
+        if (j > batch.offsets[k]) out << " x ";
+        out << batch.factors[j];
+    }
+}
+
+// Auto-tuning: calibrated thread counts are persisted per host and range
+const std::string TUNING_PROFILE_PATH = "tuning_profile.txt";
+
+std::string read_first_line(const std::string& filepath) {
+    std::ifstream input(filepath);
+    std::string line;
+    if (input.is_open()) std::getline(input, line);
+    return strip_whitespace(line);
+}
+
+// Builds a profile key from the CPU model and the cache sizes reported by sysfs
+std::string describe_host() {
+    std::string model = "Unknown CPU";
+    std::ifstream cpuinfo("/proc/cpuinfo");
+    std::string line;
+    while (std::getline(cpuinfo, line)) {
+        if (line.find("model name") == 0) {
+            model = strip_whitespace(line.substr(line.find(':') + 1));
+            break;
+        }
+    }
+
+    std::string caches;
+    for (int index = 0; ; ++index) {
+        std::string base = "/sys/devices/system/cpu/cpu0/cache/index" + std::to_string(index) + "/";
+        std::string level = read_first_line(base + "level");
+        if (level.empty()) break;
+        std::string type = read_first_line(base + "type");
+        std::string suffix = (type == "Data") ? "d" : (type == "Instruction") ? "i" : "";
+        caches += " L" + level + suffix + ":" + read_first_line(base + "size");
+    }
+    if (caches.empty()) caches = " caches:unknown";
+
+    return model + " |" + caches + " | " + std::to_string(std::thread::hardware_concurrency()) + " cpus";
+}
+
+int lookup_tuned_threads(const std::string& key) {
+    std::ifstream input(TUNING_PROFILE_PATH);
+    std::string line;
+    while (std::getline(input, line)) {
+        line = strip_whitespace(line);
+        if (line.empty() || line[0] == '#') continue;
+
+        auto delimiter = line.rfind('=');
+        if (delimiter == std::string::npos) continue;
+
+        if (strip_whitespace(line.substr(0, delimiter)) != key) continue;
+
+        // The profile is only a cache; skip damaged entries so the caller recalibrates
+        try {
+            int threads = std::stoi(strip_whitespace(line.substr(delimiter + 1)));
+            if (threads > 0) return threads;
+        } catch (const std::exception&) {
+        }
+    }
+    return 0;
+}
+
+void store_tuned_threads(const std::string& key, int threads) {
+    std::ofstream output(TUNING_PROFILE_PATH, std::ios::app);
+    if (!output.is_open()) {
+        std::cerr << "Warning: could not write tuning profile " << TUNING_PROFILE_PATH << std::endl;
+        return;
+    }
+    output << key << " = " << threads << "\n";
+}
+
+int bit_width_of(uint64_t value) {
+    int bits = 0;
+    while (value) { ++bits; value >>= 1; }
+    return bits;
+}
+
+// Calibration tests a short run of numbers at the top of the range (capped so a run stays quick),
+// formatting the same log lines under output_lock but discarding them instead of printing
+struct DiscardBuffer : std::streambuf {
+    int overflow(int ch) override { return ch; }
+};
+
+DiscardBuffer discard_buffer;
+std::ostream discarded_log(&discard_buffer);
+
+const std::string VARIANT_TAG = "A1-B2";
+const uint64_t CALIBRATION_SPAN = 256;
+const uint64_t CALIBRATION_CEILING = 1ULL << 24;
+const uint64_t FACTOR_CALIBRATION_SPAN = 1 << 12;
+const int CALIBRATION_REPEATS = 3;
+const auto CALIBRATION_MIN_DURATION = std::chrono::milliseconds(10);
+
+void run_calibration_workload(const Settings& cfg, int threads) {
+    if (cfg.factor_mode) {
+        // Sample at most an eighth of the range so calibration stays well short of the real job
+        uint64_t span = std::min(FACTOR_CALIBRATION_SPAN, (cfg.upper_limit - cfg.lower_limit) / 8 + 1);
+        run_factor_pool(cfg.upper_limit - (span - 1), cfg.upper_limit, threads, [](FactorBatch&) {});
+        return;
+    }
+
+    uint64_t top = std::min(cfg.upper_limit, CALIBRATION_CEILING);
+    uint64_t bottom = (top > CALIBRATION_SPAN + 2) ? top - CALIBRATION_SPAN : 2;
+    for (uint64_t num = bottom; num <= top; ++num) {
+        check_primality_threaded(num, threads, discarded_log);
+    }
+}
+
+// Repeats the workload until it has run for CALIBRATION_MIN_DURATION so short ranges are not
+// judged on thread start-up noise; returns the average time per run
+std::chrono::steady_clock::duration time_calibration_workload(const Settings& cfg, int threads) {
+    int runs = 0;
+    auto start = std::chrono::steady_clock::now();
+    auto elapsed = std::chrono::steady_clock::duration::zero();
+    do {
+        run_calibration_workload(cfg, threads);
+        ++runs;
+        elapsed = std::chrono::steady_clock::now() - start;
+    } while (elapsed < CALIBRATION_MIN_DURATION);
+    return elapsed / runs;
+}
+
+// Times the calibration workload at each candidate thread count and keeps the fastest
+int calibrate_thread_count(const Settings& cfg) {
+    int hardware = std::max(1, static_cast<int>(std::thread::hardware_concurrency()));
+    std::vector<int> candidates;
+    for (int t = 1; t < hardware * 2; t *= 2) candidates.push_back(t);
+    candidates.push_back(hardware);
+    candidates.push_back(hardware * 2);
+    std::sort(candidates.begin(), candidates.end());
+    candidates.erase(std::unique(candidates.begin(), candidates.end()), candidates.end());
+
+    int best_threads = 1;
+    auto best_time = std::chrono::steady_clock::duration::max();
+    for (int threads : candidates) {
+        auto fastest = std::chrono::steady_clock::duration::max();
+        for (int rep = 0; rep < CALIBRATION_REPEATS; ++rep) {
+            auto elapsed = time_calibration_workload(cfg, threads);
+
+            // Stop repeating once two timings agree within 5%
+            bool settled = (elapsed < fastest) ? (fastest - elapsed < elapsed / 20)
+                                               : (elapsed - fastest < fastest / 20);
+            fastest = std::min(fastest, elapsed);
+            if (settled) break;
+        }
+        std::cout << "[Auto-Tune] " << threads << " threads: "
+                  << std::chrono::duration_cast<std::chrono::microseconds>(fastest).count() << " us" << std::endl;
+
+        // Only accept more threads when they are clearly faster
+        if (fastest < best_time - best_time / 20) {
+            best_time = fastest;
+            best_threads = threads;
+        }
+    }
+    return best_threads;
+}
+
+int resolve_thread_count(const Settings& cfg) {
+    std::string tag = cfg.factor_mode ? VARIANT_TAG + " factor" : VARIANT_TAG;
+    // Ranges above the calibration ceiling all run the same prime-mode benchmark, so they share one entry
+    uint64_t calibrated_limit = cfg.factor_mode ? cfg.upper_limit : std::min(cfg.upper_limit, CALIBRATION_CEILING);
+    std::string key = describe_host() + " | " + tag + " | range 2^" + std::to_string(bit_width_of(calibrated_limit));
+
+    int threads = lookup_tuned_threads(key);
+    if (threads > 0) {
+        std::cout << "[Auto-Tune] Using saved profile: " << threads << " threads" << std::endl;
+        return threads;
+    }
+
+    std::cout << "[Auto-Tune] No profile for this host, calibrating..." << std::endl;
+    threads = calibrate_thread_count(cfg);
+    store_tuned_threads(key, threads);
+    std::cout << "[Auto-Tune] Saved " << threads << " threads to " << TUNING_PROFILE_PATH << std::endl;
+    return threads;
+}
+
 std::atomic<uint64_t> total_numbers_processed(0);
 std::atomic<uint64_t> total_primes_found(0);
 
@@ -137,7 +583,7 @@ void execute_prime_search(const Settings& cfg) {
     for (uint64_t num = 2; num <= cfg.upper_limit; ++num) {
         total_numbers_processed++;
         
-        if (check_primality_threaded(num, cfg.thread_count)) {
+        if (check_primality_threaded(num, cfg.thread_count, std::cout)) {
             total_primes_found++;
             auto now = std::chrono::system_clock::now();
             std::lock_guard<std::mutex> guard(output_lock);
@@ -155,13 +601,67 @@ void execute_prime_search(const Settings& cfg) {
     std::cout << "Total Execution Time: " << elapsed.count() << " ms" << std::endl;
 }
 
+void execute_factor_search(const Settings& cfg) {
+    std::cout << "\n========== VARIANT A1-B2 (FACTOR MODE) ==========" << std::endl;
+    std::cout << "A1: Print Immediately | B2: Worker Pool Factoring Batches of "
+              << factor_batch_size(cfg.lower_limit, cfg.upper_limit, cfg.thread_count) << std::endl;
+    std::cout << "Configuration: " << cfg.thread_count << " threads | Range: " << cfg.lower_limit << " - " << cfg.upper_limit << std::endl;
+
+    auto program_start = std::chrono::system_clock::now();
+    std::cout << "Program Start: " << get_timestamp(program_start) << "\n" << std::endl;
+
+    total_numbers_processed.store(0);
+    total_primes_found.store(0);
+
+    // Each batch is printed as soon as its worker finishes it
+    run_factor_pool(cfg.lower_limit, cfg.upper_limit, cfg.thread_count, [](FactorBatch& batch) {
+        std::string stamp = get_timestamp(batch.completed_at);
+        std::ostringstream lines;
+        uint64_t primes = 0;
+
+        for (size_t k = 0; k < batch.values.size(); ++k) {
+            lines << "[" << stamp << "] [Thread " << batch.worker_id << "] ";
+            if (batch.offsets[k + 1] - batch.offsets[k] == 1) {
+                ++primes;
+                lines << "Prime found: " << batch.values[k] << "\n";
+            } else {
+                write_factorization(lines, batch, k);
+                lines << " - COMPOSITE\n";
+            }
+        }
+
+        total_numbers_processed += batch.values.size();
+        total_primes_found += primes;
+        std::lock_guard<std::mutex> guard(output_lock);
+        std::cout << lines.str() << std::flush;
+    });
+
+    auto program_end = std::chrono::system_clock::now();
+    auto elapsed = std::chrono::duration_cast<std::chrono::milliseconds>(program_end - program_start);
+    uint64_t processed = total_numbers_processed.load();
+
+    std::cout << "\n=======================================================================" << std::endl;
+    std::cout << "Program End: " << get_timestamp(program_end) << std::endl;
+    std::cout << "Numbers Processed: " << processed << std::endl;
+    std::cout << "Total Primes Found: " << total_primes_found.load() << std::endl;
+    std::cout << "Composites Factored: " << processed - total_primes_found.load() << std::endl;
+    std::cout << "Total Execution Time: " << elapsed.count() << " ms" << std::endl;
+    std::cout << "Throughput: " << processed * 1000 / std::max<int64_t>(elapsed.count(), 1) << " numbers/s" << std::endl;
+}
+
 int main() {
     try {
         Settings cfg = load_configuration("config.txt");
         std::cout << "\n[Configuration Loaded]" << std::endl;
+        if (cfg.auto_threads) cfg.thread_count = resolve_thread_count(cfg);
         std::cout << "Thread Count: " << cfg.thread_count << std::endl;
         std::cout << "Upper Limit: " << cfg.upper_limit << std::endl;
-        execute_prime_search(cfg);
+        if (cfg.factor_mode) {
+            std::cout << "Mode: factor (from " << cfg.lower_limit << ")" << std::endl;
+            execute_factor_search(cfg);
+        } else {
+            execute_prime_search(cfg);
+        }
     } catch (const std::exception& ex) {
         std::cerr << "Error: " << ex.what() << std::endl;
         return 1;
@@ -7,6 +7,7 @@
 #include <cmath>
 #include <sstream>
 #include <iomanip>
+#include <functional>
 #include <algorithm>
 #include <map>
 
@@ -20,6 +21,7 @@ std::string strip_whitespace(const std::string& str) {
 struct Settings {
     int thread_count;
     uint64_t upper_limit;
+    bool auto_threads;
 };
 
 struct PrimeData {
@@ -33,7 +35,7 @@ std::mutex data_lock;
 std::vector<PrimeData> discovered_primes;
 
 Settings load_configuration(const std::string& filepath) {
-    Settings settings;
+    Settings settings{};
     std::ifstream input(filepath);
     if (!input.is_open()) {
         throw std::runtime_error("Failed to open configuration file: " + filepath);
@@ -51,7 +53,11 @@ Settings load_configuration(const std::string& filepath) {
         std::string val = strip_whitespace(line.substr(delimiter + 1));
 
         if (key == "Threads") {
-            settings.thread_count = std::stoi(val);
+            if (val == "auto") {
+                settings.auto_threads = true;
+            } else {
+                settings.thread_count = std::stoi(val);
+            }
         } else if (key == "Max Value") {
             if (val.find("2^") == 0) {
                 int exp = std::stoi(val.substr(2));
@@ -82,13 +88,13 @@ std::string get_timestamp(const std::chrono::system_clock::time_point& point) {
     return stream.str();
 }
 
-void collect_primes_from_range(uint64_t lower, uint64_t upper, int thread_id) {
+void collect_primes_from_range(uint64_t lower, uint64_t upper, int thread_id, std::ostream& log) {
     auto begin_time = std::chrono::system_clock::now();
     
     {
         std::lock_guard<std::mutex> guard(output_lock);
-        std::cout << "Thread " << thread_id << " started: range [" << lower << "-" << upper 
-                  << "] @ " << get_timestamp(begin_time) << std::endl;
+        log << "Thread " << thread_id << " started: range [" << lower << "-" << upper 
+            << "] @ " << get_timestamp(begin_time) << std::endl;
     }
 
     std::vector<PrimeData> local_primes;
@@ -106,8 +112,181 @@ void collect_primes_from_range(uint64_t lower, uint64_t upper, int thread_id) {
 
     auto end_time = std::chrono::system_clock::now();
     std::lock_guard<std::mutex> guard(output_lock);
-    std::cout << "Thread " << thread_id << " completed @ " << get_timestamp(end_time) 
-              << " (Found " << local_primes.size() << " primes)" << std::endl;
+    log << "Thread " << thread_id << " completed @ " << get_timestamp(end_time) 
+        << " (Found " << local_primes.size() << " primes)" << std::endl;
+}
+
+// Auto-tuning: calibrated thread counts are persisted per host and range
+const std::string TUNING_PROFILE_PATH = "tuning_profile.txt";
+
+std::string read_first_line(const std::string& filepath) {
+    std::ifstream input(filepath);
+    std::string line;
+    if (input.is_open()) std::getline(input, line);
+    return strip_whitespace(line);
+}
+
+// Builds a profile key from the CPU model and the cache sizes reported by sysfs
+std::string describe_host() {
+    std::string model = "Unknown CPU";
+    std::ifstream cpuinfo("/proc/cpuinfo");
+    std::string line;
+    while (std::getline(cpuinfo, line)) {
+        if (line.find("model name") == 0) {
+            model = strip_whitespace(line.substr(line.find(':') + 1));
+            break;
+        }
+    }
+
+    std::string caches;
+    for (int index = 0; ; ++index) {
+        std::string base = "/sys/devices/system/cpu/cpu0/cache/index" + std::to_string(index) + "/";
+        std::string level = read_first_line(base + "level");
+        if (level.empty()) break;
+        std::string type = read_first_line(base + "type");
+        std::string suffix = (type == "Data") ? "d" : (type == "Instruction") ? "i" : "";
+        caches += " L" + level + suffix + ":" + read_first_line(base + "size");
+    }
+    if (caches.empty()) caches = " caches:unknown";
+
+    return model + " |" + caches + " | " + std::to_string(std::thread::hardware_concurrency()) + " cpus";
+}
+
+int lookup_tuned_threads(const std::string& key) {
+    std::ifstream input(TUNING_PROFILE_PATH);
+    std::string line;
+    while (std::getline(input, line)) {
+        line = strip_whitespace(line);
+        if (line.empty() || line[0] == '#') continue;
+
+        auto delimiter = line.rfind('=');
+        if (delimiter == std::string::npos) continue;
+
+        if (strip_whitespace(line.substr(0, delimiter)) != key) continue;
+
+        // The profile is only a cache; skip damaged entries so the caller recalibrates
+        try {
+            int threads = std::stoi(strip_whitespace(line.substr(delimiter + 1)));
+            if (threads > 0) return threads;
+        } catch (const std::exception&) {
+        }
+    }
+    return 0;
+}
+
+void store_tuned_threads(const std::string& key, int threads) {
+    std::ofstream output(TUNING_PROFILE_PATH, std::ios::app);
+    if (!output.is_open()) {
+        std::cerr << "Warning: could not write tuning profile " << TUNING_PROFILE_PATH << std::endl;
+        return;
+    }
+    output << key << " = " << threads << "\n";
+}
+
+int bit_width_of(uint64_t value) {
+    int bits = 0;
+    while (value) { ++bits; value >>= 1; }
+    return bits;
+}
+
+// Calibration searches a short window at the top of the range (capped so a run stays quick),
+// split across threads and logged the same way the real search is, with the log lines discarded
+struct DiscardBuffer : std::streambuf {
+    int overflow(int ch) override { return ch; }
+};
+
+DiscardBuffer discard_buffer;
+std::ostream discarded_log(&discard_buffer);
+
+const std::string VARIANT_TAG = "A2-B1";
+const uint64_t CALIBRATION_SPAN = 20000;
+const uint64_t CALIBRATION_CEILING = 1ULL << 32;
+const int CALIBRATION_REPEATS = 3;
+const auto CALIBRATION_MIN_DURATION = std::chrono::milliseconds(10);
+
+void run_calibration_workload(const Settings& cfg, int threads) {
+    uint64_t top = std::min(cfg.upper_limit, CALIBRATION_CEILING);
+    uint64_t bottom = (top > CALIBRATION_SPAN + 2) ? top - CALIBRATION_SPAN : 2;
+    uint64_t segment_size = (top - bottom + 1) / threads;
+
+    std::vector<std::thread> workers;
+    for (int i = 0; i < threads; ++i) {
+        uint64_t lower = bottom + i * segment_size;
+        uint64_t upper = (i == threads - 1) ? top : (lower + segment_size - 1);
+        workers.emplace_back(collect_primes_from_range, lower, upper, i, std::ref(discarded_log));
+    }
+    for (auto& worker : workers) worker.join();
+
+    // Drop what the calibration runs merged into the shared results
+    std::lock_guard<std::mutex> guard(data_lock);
+    discovered_primes.clear();
+}
+
+// Repeats the workload until it has run for CALIBRATION_MIN_DURATION so short ranges are not
+// judged on thread start-up noise; returns the average time per run
+std::chrono::steady_clock::duration time_calibration_workload(const Settings& cfg, int threads) {
+    int runs = 0;
+    auto start = std::chrono::steady_clock::now();
+    auto elapsed = std::chrono::steady_clock::duration::zero();
+    do {
+        run_calibration_workload(cfg, threads);
+        ++runs;
+        elapsed = std::chrono::steady_clock::now() - start;
+    } while (elapsed < CALIBRATION_MIN_DURATION);
+    return elapsed / runs;
+}
+
+// Times the calibration workload at each candidate thread count and keeps the fastest
+int calibrate_thread_count(const Settings& cfg) {
+    int hardware = std::max(1, static_cast<int>(std::thread::hardware_concurrency()));
+    std::vector<int> candidates;
+    for (int t = 1; t < hardware * 2; t *= 2) candidates.push_back(t);
+    candidates.push_back(hardware);
+    candidates.push_back(hardware * 2);
+    std::sort(candidates.begin(), candidates.end());
+    candidates.erase(std::unique(candidates.begin(), candidates.end()), candidates.end());
+
+    int best_threads = 1;
+    auto best_time = std::chrono::steady_clock::duration::max();
+    for (int threads : candidates) {
+        auto fastest = std::chrono::steady_clock::duration::max();
+        for (int rep = 0; rep < CALIBRATION_REPEATS; ++rep) {
+            auto elapsed = time_calibration_workload(cfg, threads);
+
+            // Stop repeating once two timings agree within 5%
+            bool settled = (elapsed < fastest) ? (fastest - elapsed < elapsed / 20)
+                                               : (elapsed - fastest < fastest / 20);
+            fastest = std::min(fastest, elapsed);
+            if (settled) break;
+        }
+        std::cout << "[Auto-Tune] " << threads << " threads: "
+                  << std::chrono::duration_cast<std::chrono::microseconds>(fastest).count() << " us" << std::endl;
+
+        // Only accept more threads when they are clearly faster
+        if (fastest < best_time - best_time / 20) {
+            best_time = fastest;
+            best_threads = threads;
+        }
+    }
+    return best_threads;
+}
+
+int resolve_thread_count(const Settings& cfg) {
+    // Ranges above the calibration ceiling all run the same benchmark, so they share one entry
+    int range_bits = bit_width_of(std::min(cfg.upper_limit, CALIBRATION_CEILING));
+    std::string key = describe_host() + " | " + VARIANT_TAG + " | range 2^" + std::to_string(range_bits);
+
+    int threads = lookup_tuned_threads(key);
+    if (threads > 0) {
+        std::cout << "[Auto-Tune] Using saved profile: " << threads << " threads" << std::endl;
+        return threads;
+    }
+
+    std::cout << "[Auto-Tune] No profile for this host, calibrating..." << std::endl;
+    threads = calibrate_thread_count(cfg);
+    store_tuned_threads(key, threads);
+    std::cout << "[Auto-Tune] Saved " << threads << " threads to " << TUNING_PROFILE_PATH << std::endl;
+    return threads;
 }
 
 void execute_prime_search(const Settings& cfg) {
@@ -125,7 +304,7 @@ void execute_prime_search(const Settings& cfg) {
     for (int i = 0; i < cfg.thread_count; ++i) {
         uint64_t lower = (i == 0) ? 2 : (i * segment_size + 1);
         uint64_t upper = (i == cfg.thread_count - 1) ? cfg.upper_limit : ((i + 1) * segment_size);
-        workers.emplace_back(collect_primes_from_range, lower, upper, i);
+        workers.emplace_back(collect_primes_from_range, lower, upper, i, std::ref(std::cout));
     }
 
     for (auto& worker : workers) worker.join();
@@ -173,6 +352,7 @@ int main() {
     try {
         Settings cfg = load_configuration("config.txt");
         std::cout << "\n[Configuration Loaded]" << std::endl;
+        if (cfg.auto_threads) cfg.thread_count = resolve_thread_count(cfg);
         std::cout << "Thread Count: " << cfg.thread_count << std::endl;
         std::cout << "Upper Limit: " << cfg.upper_limit << std::endl;
         execute_prime_search(cfg);